@@ -227,17 +227,113 @@ uint64_t hash_mix(uint64_t x, uint64_t y) {
     return x;
 }
 
-uint64_t hash_bytes(const void *ptr, size_t len) {
-    uint64_t x = 0xcbf29ce484222325;
-    const char *buf = (const char *)ptr;
-    for (size_t i = 0; i < len; i++) {
-        x ^= buf[i];
-        x *= 0x100000001b3;
-        x ^= x >> 32;
-    }
+// Word-at-a-time multiply-mix hash, the same function as std.hash. Short keys take two
+// overlapping loads, longer keys go 32 bytes per iteration over four independent lanes.
+#define HASH_P1 0x9e3779b185ebca87ull
+#define HASH_P2 0xc2b2ae3d27d4eb4full
+#define HASH_P3 0x165667b19e3779f9ull
+#define HASH_P4 0x85ebca77c2b2ae63ull
+#define HASH_P5 0x27d4eb2f165667c5ull
+
+static inline uint64_t hash_read64(const uint8_t *ptr) {
+    uint64_t x;
+    memcpy(&x, ptr, sizeof(x));
+    return x;
+}
+
+static inline uint64_t hash_read32(const uint8_t *ptr) {
+    uint32_t x;
+    memcpy(&x, ptr, sizeof(x));
     return x;
 }
 
+static inline uint64_t hash_rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+static inline uint64_t hash_round(uint64_t acc, uint64_t word) {
+    return hash_rotl(acc + word * HASH_P2, 31) * HASH_P1;
+}
+
+static inline uint64_t hash_step(uint64_t h, uint64_t word) {
+    return hash_rotl(h ^ hash_round(0, word), 27) * HASH_P1 + HASH_P4;
+}
+
+static inline uint64_t hash_avalanche(uint64_t h) {
+    h ^= h >> 33;
+    h *= HASH_P2;
+    h ^= h >> 29;
+    h *= HASH_P3;
+    h ^= h >> 32;
+    return h;
+}
+
+uint64_t hash_bytes(const void *buf, size_t len) {
+    const uint8_t *ptr = (const uint8_t *)buf;
+    const uint8_t *end = ptr + len;
+    if (len <= 16) {
+        uint64_t lo = 0, hi = 0;
+        if (len >= 8) {
+            lo = hash_read64(ptr);
+            hi = hash_read64(end - 8);
+        } else if (len >= 4) {
+            lo = hash_read32(ptr);
+            hi = hash_read32(end - 4);
+        } else if (len) {
+            lo = ptr[0] | (ptr[len >> 1] << 8) | (ptr[len - 1] << 16);
+        }
+        return hash_avalanche(hash_step(hash_step(HASH_P5 + len, lo), hi));
+    }
+    uint64_t h;
+    if (len >= 32) {
+        uint64_t v1 = HASH_P1 + HASH_P2;
+        uint64_t v2 = HASH_P2;
+        uint64_t v3 = 0;
+        uint64_t v4 = -HASH_P1;
+        for (; ptr + 32 <= end; ptr += 32) {
+            v1 = hash_round(v1, hash_read64(ptr));
+            v2 = hash_round(v2, hash_read64(ptr + 8));
+            v3 = hash_round(v3, hash_read64(ptr + 16));
+            v4 = hash_round(v4, hash_read64(ptr + 24));
+        }
+        h = hash_rotl(v1, 1) + hash_rotl(v2, 7) + hash_rotl(v3, 12) + hash_rotl(v4, 18);
+        h = (h ^ hash_round(0, v1)) * HASH_P1 + HASH_P4;
+        h = (h ^ hash_round(0, v2)) * HASH_P1 + HASH_P4;
+        h = (h ^ hash_round(0, v3)) * HASH_P1 + HASH_P4;
+        h = (h ^ hash_round(0, v4)) * HASH_P1 + HASH_P4;
+    } else {
+        h = HASH_P5;
+    }
+    h += len;
+    for (; ptr + 8 <= end; ptr += 8) {
+        h = hash_step(h, hash_read64(ptr));
+    }
+    if (ptr < end) {
+        h = hash_step(h, hash_read64(end - 8));
+    }
+    return hash_avalanche(h);
+}
+
+void hash_test(void) {
+    // Reference values shared with std.hash.
+    assert(hash_bytes("", 0) == 0x50bebf6edbd6cf00);
+    assert(hash_bytes("abc", 3) == 0x0210ddcdbeff9c04);
+    assert(hash_bytes("hello world!", 12) == 0x303c887844ec4817);
+    assert(hash_bytes("0123456789abcdefg", 17) == 0xb84038851b7b28b9);
+    assert(hash_bytes("The quick brown fox jumps over the lazy dog", 43) == 0x65283f5919d62291);
+    char buf[128];
+    memset(buf, 'a', sizeof(buf));
+    uint64_t *hashes = NULL;
+    for (size_t len = 0; len <= sizeof(buf); len++) {
+        uint64_t h = hash_bytes(buf, len);
+        for (size_t i = 0; i < buf_len(hashes); i++) {
+            assert(hashes[i] != h);
+        }
+        buf_push(hashes, h);
+    }
+    buf_free(hashes);
+}
+
 typedef struct Map {
     uint64_t *keys;
     uint64_t *vals;
@@ -11,6 +11,13 @@
         .reg rp x26
         .reg pc x27
         .reg xt x28
+        .reg lr x29
+
+        // With FORTH_NATIVE defined as nonzero before assembly, the kernel's colon definitions are
+        // compiled to native code instead of threaded lists of execution tokens.
+        .ifndef FORTH_NATIVE
+        FORTH_NATIVE = 0
+        .endif
 
         LATEST = 0
 
@@ -38,21 +45,29 @@ $label: .endmacro
         .ptr docol
         .endmacro
 
-        .macro defop2 label, name, instr
-        $defcode $label, $name
+        .macro op2 instr
         lw t1, [sp, -8]
         lw t2, [sp, -4]
         sub sp, 4
         $instr t1, t2
         sw [sp, -4], t1
-        $next
         .endmacro
 
-        .macro defop1 label, name, instr
-        $defcode $label, $name
+        .macro op1 instr
         lw t1, [sp, -4]
         $instr t1
         sw [sp, -4], t1
+        .endmacro
+
+        .macro defop2 label, name, instr
+        $defcode $label, $name
+        $op2 $instr
+        $next
+        .endmacro
+
+        .macro defop1 label, name, instr
+        $defcode $label, $name
+        $op1 $instr
         $next
         .endmacro
 
@@ -67,6 +82,131 @@ $label: .endmacro
         $execute
         .endmacro
 
+        // A native colon definition keeps a code field like a primitive's, so threaded code can
+        // execute it. The code field's stub calls the native body and then continues with next.
+        // Native code calls the body directly with jal through lr. Bodies that call other words
+        // save lr on the return stack.
+        NATIVE_BODY_OFFSET = 24
+
+        .macro defnative label, name
+        $defentry $label, $name, 0
+        .ptr >1
+1:      jal lr, >2
+        $next
+2:      .assert $ - $label == NATIVE_BODY_OFFSET
+        .endmacro
+
+        .macro call label
+        jal lr, $label + NATIVE_BODY_OFFSET
+        .endmacro
+
+        .macro enter
+        sw [rp], lr
+        add rp, 4
+        .endmacro
+
+        .macro leave
+        sub rp, 4
+        lw lr, [rp]
+        jmp [lr]
+        .endmacro
+
+        .macro return
+        jmp [lr]
+        .endmacro
+
+        .macro lit value
+        li t1, $value
+        add sp, 4
+        sw [sp, -4], t1
+        .endmacro
+
+        .macro lit_addr label
+        la t1, $label
+        add sp, 4
+        sw [sp, -4], t1
+        .endmacro
+
+        .macro branch_nz target
+        lw t1, [sp, -4]
+        sub sp, 4
+        bne t1, 0, $target
+        .endmacro
+
+        // The bodies of primitives that native code inlines.
+        .macro code_drop
+        sub sp, 4
+        .endmacro
+
+        .macro code_dup
+        lw t1, [sp, -4]
+        add sp, 4
+        sw [sp, -4], t1
+        .endmacro
+
+        .macro code_over
+        lw t1, [sp, -8]
+        add sp, 4
+        sw [sp, -4], t1
+        .endmacro
+
+        .macro code_swap
+        lw t1, [sp, -8]
+        lw t2, [sp, -4]
+        sw [sp, -4], t1
+        sw [sp, -8], t2
+        .endmacro
+
+        .macro code_rot
+        lw t1, [sp, -12]
+        lw t2, [sp, -8]
+        lw t3, [sp, -4]
+        sw [sp, -12], t3
+        sw [sp, -8], t1
+        sw [sp, -4], t2
+        .endmacro
+
+        .macro code_nrot
+        lw t1, [sp, -12]
+        lw t2, [sp, -8]
+        lw t3, [sp, -4]
+        sw [sp, -12], t2
+        sw [sp, -8], t3
+        sw [sp, -4], t1
+        .endmacro
+
+        .macro code_invert
+        lw t1, [sp, -4]
+        xor t1, ~0
+        sw [sp, -4], t1
+        .endmacro
+
+        .macro code_load
+        lw t1, [sp, -4]
+        lw t1, [t1]
+        sw [sp, -4], t1
+        .endmacro
+
+        .macro code_store
+        lw t1, [sp, -4]
+        lw t2, [sp, -8]
+        sub sp, 8
+        sw [t1], t2
+        .endmacro
+
+        .macro code_cload
+        lw t1, [sp, -4]
+        lbu t1, [t1]
+        sw [sp, -4], t1
+        .endmacro
+
+        .macro code_cstore
+        lw t1, [sp, -4]
+        lw t2, [sp, -8]
+        sub sp, 8
+        sb [t1], t2
+        .endmacro
+
 init:
         la sp, stack
         la rp, return_stack
@@ -124,45 +264,28 @@ docol:
         $next
 
         $defcode _drop, "drop"
-        sub sp, 4
+        $code_drop
         $next
 
         $defcode _dup, "dup"
-        lw t1, [sp, -4]
-        add sp, 4
-        sw [sp, -4], t1
+        $code_dup
         $next
 
         $defcode _over, "over"
-        lw t1, [sp, -8]
-        add sp, 4
-        sw [sp, -4], t1
+        $code_over
         $next
 
         $defcode _swap, "swap"
-        lw t1, [sp, -8]
-        lw t2, [sp, -4]
-        sw [sp, -4], t1
-        sw [sp, -8], t2
+        $code_swap
         $next
 
         $defcode _rot, "rot"
-        lw t1, [sp, -12]
-        lw t2, [sp, -8]
-        lw t3, [sp, -4]
-        sw [sp, -12], t3
-        sw [sp, -8], t1
-        sw [sp, -4], t2
+        $code_rot
         $next
 
         // : -rot  rot rot ;
         $defcode _nrot, "-rot"
-        lw t1, [sp, -12]
-        lw t2, [sp, -8]
-        lw t3, [sp, -4]
-        sw [sp, -12], t2
-        sw [sp, -8], t3
-        sw [sp, -4], t1
+        $code_nrot
         $next
 
         $defcode _lit, "lit"
@@ -183,9 +306,7 @@ docol:
         $defop1 _nez, "0<>", snez
 
         $defcode _invert, "invert"
-        lw t1, [sp, -4]
-        xor t1, ~0
-        sw [sp, -4], t1
+        $code_invert
         $next
 
         $defcode _exit, "exit"
@@ -214,29 +335,19 @@ docol:
         $next
 
         $defcode _load, "@"
-        lw t1, [sp, -4]
-        lw t1, [t1]
-        sw [sp, -4], t1
+        $code_load
         $next
 
         $defcode _store, "!"
-        lw t1, [sp, -4]
-        lw t2, [sp, -8]
-        sub sp, 8
-        sw [t1], t2
+        $code_store
         $next
 
         $defcode _cload, "c@"
-        lw t1, [sp, -4]
-        lbu t1, [t1]
-        sw [sp, -4], t1
+        $code_cload
         $next
 
         $defcode _cstore, "c!"
-        lw t1, [sp, -4]
-        lw t2, [sp, -8]
-        sub sp, 8
-        sb [t1], t2
+        $code_cstore
         $next
 
         $defcode _execute, "execute"
@@ -252,7 +363,7 @@ docol:
         .print "Set next address as breakpoint:", $
         $next
 
-        $defcode _find, "find"              // ( name len -- ent )
+        .macro code_find
         lw t1, [sp, -8]                     // char *name = sp[-2];
         lw t2, [sp, -4]                     // uint32 len = sp[-1];
         sub sp, 4                           // sp--;
@@ -274,9 +385,13 @@ docol:
 4:          lw t3, [t3, LINK_OFFSET]        //     next: ent = ent->link;
 5:          bne t3, 0, <1                   // }
 6:      sw [sp, -4], t3                     // done: sp[-1] = ent;
+        .endmacro
+
+        $defcode _find, "find"              // ( name len -- ent )
+        $code_find
         $next
 
-        $defcode _word, "word"              // ( -- addr len )
+        .macro code_word
         lw t1, input                        // char *src = input;
         lw t2, input_end                    // char *end = input_end;
         la t4, word_buf                     // char *start = word_buf;
@@ -305,17 +420,238 @@ docol:
 4:      sw input, t1, t6                    // done: input = src;
         sub t5, t4                          // uint32 len = dest - start;
         sw [sp, -4], t5                     // sp[-1] = len;
+        .endmacro
+
+        $defcode _word, "word"              // ( -- addr len )
+        $code_word
         $next
 
-        $defcode _cfa, ">cfa"
+        .macro code_cfa
         lw t1, [sp, -4]
         lbu t2, [t1, NAMELEN_OFFSET]
         add t2, NAME_OFFSET + 3
         add t1, t2
         and t1, ~3
         sw [sp, -4], t1
+        .endmacro
+
+        $defcode _cfa, ">cfa"
+        $code_cfa
+        $next
+
+        .if FORTH_NATIVE
+
+        $defnative _0, "0"
+        $lit 0
+        $return
+
+        $defnative _1, "1"
+        $lit 1
+        $return
+
+        $defnative _2, "2"
+        $lit 2
+        $return
+
+        $defnative _3, "3"
+        $lit 3
+        $return
+
+        $defnative _4, "4"
+        $lit 4
+        $return
+
+        $defnative _putchar, "putchar"
+        $lit_addr putchar
+        $code_store
+        $return
+
+        $defnative _getchar, "getchar"
+        $lit_addr getchar
+        $code_load
+        $return
+
+        $defnative _latest, "latest"
+        $lit_addr latest
+        $return
+
+        $defnative _cp, "cp"
+        $lit_addr cp
+        $return
+
+        $defnative _here, "here"
+        $enter
+        $call _cp
+        $code_load
+        $leave
+
+        $defnative _allot, "allot"
+        $enter
+        $call _here
+        $op2 add
+        $call _cp
+        $code_store
+        $leave
+
+        $defnative _comma, ","
+        $enter
+        $call _here
+        $code_store
+        $lit 4
+        $call _allot
+        $leave
+
+        $defnative _ccomma, "c,"
+        $enter
+        $call _here
+        $code_cstore
+        $lit 1
+        $call _allot
+        $leave
+
+        $defnative _2dup, "2dup"
+        $code_over
+        $code_over
+        $return
+
+        $defnative _neg, "neg"
+        $lit 0
+        $code_swap
+        $op2 sub
+        $return
+
+        $defnative _mux, "mux"
+        $enter
+        $op1 snez
+        $call _neg
+        $code_nrot
+        $code_over
+        $code_invert
+        $op2 and
+        $code_rot
+        $op2 and
+        $op2 or
+        $leave
+
+        // Threaded callers keep the target in the cell after the call, so jump and branch stay
+        // primitives that move pc themselves.
+        $defcode _jump, "jump"
+        lw pc, [pc]
         $next
 
+        $defcode _branch, "branch"
+        lw t1, [sp, -4]
+        sub sp, 4
+        lw t2, [pc]
+        add pc, 4
+        beq t1, 0, >1
+        mov pc, t2
+1:      $next
+
+        $defnative _docol, "docol"
+        $lit_addr docol
+        $return
+
+        $defnative _add1, "1+"
+        $lit 1
+        $op2 add
+        $return
+
+        $defnative _sub1, "1-"
+        $lit 1
+        $op2 sub
+        $return
+
+        $defnative _aligned, "aligned"
+        $lit 3
+        $op2 add
+        $lit 3
+        $code_invert
+        $op2 and
+        $return
+
+        $defnative _align, "align"
+        $enter
+        $call _here
+        $call _aligned
+        $call _cp
+        $code_store
+        $leave
+
+        $defnative _3drop, "3drop"
+        $code_drop
+        $code_drop
+        $code_drop
+        $return
+
+        $defnative _cmove1, "cmove1"
+        $enter
+        $call _2dup
+        $code_swap
+        $code_cload
+        $code_swap
+        $code_cstore
+        $code_swap
+        $call _add1
+        $code_swap
+        $call _add1
+        $leave
+
+        $defnative _cmove, "cmove"
+        $enter
+1:      $code_dup
+        $branch_nz >2
+        $call _3drop
+        $leave
+2:      $code_rot
+        $call _cmove1
+        $code_nrot
+        $call _sub1
+        jmp <1
+
+        $defnative _create, "create"
+        $enter
+        $code_word
+        $call _here
+        $lit 0
+        $call _comma
+        $call _latest
+        $code_load
+        $call _comma
+        $call _latest
+        $code_store
+        $code_dup
+        $call _ccomma
+        $call _here
+        $code_over
+        $call _allot
+        $code_swap
+        $call _cmove
+        $call _align
+        $call _docol
+        $call _comma
+        $leave
+
+        $defnative _tick, "'"
+        $code_word
+        $code_find
+        $code_cfa
+        $return
+
+        // execute continues in threaded code, so interpret stays a threaded definition.
+        $defword _interpret, "interpret"
+        .int _tick, _execute, _exit
+
+        $defnative _input, "input"
+        $lit_addr input
+        $return
+
+        $defnative _input_end, "input-end"
+        $lit_addr input_end
+        $return
+
+        .else
+
         $defword _0, "0"
         .int _lit, 0, _exit
 
@@ -450,6 +786,8 @@ docol:
         $defword _input_end, "input-end"
         .int _lit, input_end, _exit
 
+        .endif
+
         HERE = $
 
         .assert stack - $ >= 0
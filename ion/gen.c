@@ -10,6 +10,8 @@ const char **gen_headers_buf;
 
 char *gen_preamble_buf;
 char *gen_postamble_buf;
+char *gen_instances_buf;
+Map gen_instances_map;
 
 void genln(void) {
     genf("\n%.*s", gen_indent * 4, "                                                                  ");
@@ -118,6 +120,8 @@ const char *cdecl_name(Type *type) {
         return type_name;
     } else if (type->kind == TYPE_TUPLE) {
         return strf("tuple%d", type->typeid);
+    } else if (type->kind == TYPE_VECTOR) {
+        return strf("vector%d", type->typeid);
     } else {
         assert(type->sym);
         return get_gen_name(type->sym);
@@ -293,7 +297,20 @@ bool is_tuple_reachable(Type *type) {
     return is_reachable(get_reachable(type));
 }
 
+bool is_vector_reachable(Type *type) {
+    return is_reachable(get_reachable(type));
+}
+
 void gen_forward_decls(void) {
+    for (int i = 0; i < buf_len(vector_types); i++) {
+        Type *type = vector_types[i];
+        if (is_vector_reachable(type)) {
+            const char *base = type_to_cdecl(type->base, "");
+            genlnf("typedef %s vector%d __attribute__((vector_size(%zu)));", base, type->typeid, type_sizeof(type));
+            // Unaligned alias for vload/vstore.
+            genlnf("typedef %s vector%d_u __attribute__((vector_size(%zu), aligned(1), may_alias));", base, type->typeid, type_sizeof(type));
+        }
+    }
     for (int i = 0; i < buf_len(tuple_types); i++) {
         Type *type = tuple_types[i];
         if (is_tuple_reachable(type)) {
@@ -418,6 +435,7 @@ const char *typeid_kind_names[NUM_TYPE_KINDS] = {
     [TYPE_UNION] = "TYPE_UNION",
     [TYPE_FUNC] = "TYPE_FUNC",
     [TYPE_TUPLE] = "TYPE_TUPLE",
+    [TYPE_VECTOR] = "TYPE_VECTOR",
 };
 
 const char *typeid_kind_name(Type *type) {
@@ -442,6 +460,8 @@ bool is_excluded_typeinfo(Type *type) {
         }
     } else if (type->kind == TYPE_TUPLE) {
         return !is_tuple_reachable(type);
+    } else if (type->kind == TYPE_VECTOR) {
+        return !is_vector_reachable(type);
     } else {
         return !type->sym && (type->kind == TYPE_STRUCT || type->kind == TYPE_UNION);
     }
@@ -455,6 +475,19 @@ void gen_typeid(Type *type) {
     }
 }
 
+// Monomorphized intrinsics are called through a per-type instance which std defines with NAME_spec. The instance
+// is named after the intrinsic and the array's base type, and is instantiated on first use. Each instance is
+// line-synced to the intrinsic's declaration, whose preamble defines NAME_spec.
+const char *gen_intrinsic_instance(Sym *sym, Type *base, const char *type_args) {
+    const char *name = str_intern(strf("%s__%d", sym->name, base->typeid));
+    if (!map_get(&gen_instances_map, name)) {
+        map_put(&gen_instances_map, name, (void *)name);
+        gen_buf_pos(&gen_instances_buf, sym->decl->pos);
+        buf_printf(gen_instances_buf, "%s_spec(%s, %s)\n", sym->name, name, type_args);
+    }
+    return name;
+}
+
 void gen_intrinsic(Sym *sym, Expr *expr) {
     Type *type = get_resolved_type(expr->call.args[0]);
     Type *base = is_ptr_type(type) ? unqualify_type(type->base) : 0;
@@ -477,7 +510,15 @@ void gen_intrinsic(Sym *sym, Expr *expr) {
         Type *type = get_resolved_type(expr->call.args[1]);
         genf(", %s)", type_to_cdecl(type, ""));
     } else if (sym->name == str_intern("apush") || sym->name == str_intern("aputv") || sym->name == str_intern("adelv") ||
-        sym->name == str_intern("agetvi") || sym->name == str_intern("agetvp") || sym->name == str_intern("agetv") ||
+        sym->name == str_intern("agetvi") || sym->name == str_intern("agetv")) {
+        // (f, t, a, v)
+        const char *types = type_to_cdecl(base, "");
+        genf("%s(%s, %s, (", sym->name, gen_intrinsic_instance(sym, base, types), types);
+        gen_expr(expr->call.args[0]);
+        genf("), (");
+        gen_expr(expr->call.args[1]);
+        genf("))");
+    } else if (sym->name == str_intern("agetvp") ||
         sym->name == str_intern("asetcap") || sym->name == str_intern("afit") || sym->name == str_intern("acat") ||
         sym->name == str_intern("adeli") || sym->name == str_intern("aindexv") || sym->name == str_intern("asetlen")) {
         // (t, a, v)
@@ -494,8 +535,9 @@ void gen_intrinsic(Sym *sym, Expr *expr) {
         gen_expr(expr->call.args[1]);
         genf("))");
     } else if (sym->name == str_intern("afill")) {
-        // (t, a, v, n)
-        genf("%s(%s, (", sym->name, type_to_cdecl(base, ""));
+        // (f, t, a, v, n)
+        const char *types = type_to_cdecl(base, "");
+        genf("%s(%s, %s, (", sym->name, gen_intrinsic_instance(sym, base, types), types);
         gen_expr(expr->call.args[0]);
         genf("), (");
         gen_expr(expr->call.args[1]);
@@ -510,20 +552,32 @@ void gen_intrinsic(Sym *sym, Expr *expr) {
         genf("), (");
         gen_expr(expr->call.args[2]);
         genf("))");
-    } else if (sym->name == str_intern("aindex") || sym->name == str_intern("ageti") || sym->name == str_intern("adel")) {
+    } else if (sym->name == str_intern("aindex")) {
         genf("%s(%s, %s, (", sym->name, type_to_cdecl(base, ""), type_to_cdecl(key, ""));
         gen_expr(expr->call.args[0]);
         genf("), (");
         gen_expr(expr->call.args[1]);
         genf("))");
+    } else if (sym->name == str_intern("ageti") || sym->name == str_intern("adel")) {
+        // (f, t, tk, a, k)
+        const char *types = strf("%s, %s", type_to_cdecl(base, ""), type_to_cdecl(key, ""));
+        genf("%s(%s, %s, (", sym->name, gen_intrinsic_instance(sym, base, types), types);
+        gen_expr(expr->call.args[0]);
+        genf("), (");
+        gen_expr(expr->call.args[1]);
+        genf("))");
     } else if (sym->name == str_intern("agetp") || sym->name == str_intern("aget")) {
-        genf("%s(%s, %s, %s, (", sym->name, type_to_cdecl(base, ""), type_to_cdecl(key, ""), type_to_cdecl(val, ""));
+        // (f, t, tk, tv, a, k)
+        const char *types = strf("%s, %s, %s", type_to_cdecl(base, ""), type_to_cdecl(key, ""), type_to_cdecl(val, ""));
+        genf("%s(%s, %s, (", sym->name, gen_intrinsic_instance(sym, base, types), types);
         gen_expr(expr->call.args[0]);
         genf("), (");
         gen_expr(expr->call.args[1]);
         genf("))");
     } else if (sym->name == str_intern("aput")) {
-        genf("%s(%s, %s, (", sym->name, type_to_cdecl(base, ""), type_to_cdecl(key, ""));
+        // (f, t, tk, a, k, v)
+        const char *types = strf("%s, %s", type_to_cdecl(base, ""), type_to_cdecl(key, ""));
+        genf("%s(%s, %s, (", sym->name, gen_intrinsic_instance(sym, base, types), types);
         gen_expr(expr->call.args[0]);
         genf("), (");
         gen_expr(expr->call.args[1]);
@@ -542,6 +596,58 @@ void gen_intrinsic(Sym *sym, Expr *expr) {
         genf("%s(%s, ", sym->name, type_to_cdecl(result_type->base, ""));
         gen_expr(expr->call.args[0]);
         genf(")");
+    } else if (sym->name == str_intern("atomic_load") || sym->name == str_intern("atomic_store") ||
+        sym->name == str_intern("atomic_exchange") || sym->name == str_intern("atomic_cas") || sym->name == str_intern("atomic_add")) {
+        // Lowered to the C11 generics on an _Atomic view of the operand; the order is the last argument.
+        const char *c11_name = sym->name == str_intern("atomic_cas") ? "atomic_compare_exchange_strong_explicit" :
+            sym->name == str_intern("atomic_add") ? "atomic_fetch_add_explicit" : strf("%s_explicit", sym->name);
+        genf("%s((%s)(", c11_name, type_to_cdecl(base, "_Atomic *"));
+        gen_expr(expr->call.args[0]);
+        genf("), ");
+        for (int i = 1; i < expr->call.num_args - 1; i++) {
+            genf("(");
+            gen_expr(expr->call.args[i]);
+            genf("), ");
+        }
+        Expr *order = expr->call.args[expr->call.num_args - 1];
+        genf("(memory_order)(");
+        gen_expr(order);
+        genf(")");
+        if (sym->name == str_intern("atomic_cas")) {
+            genf(", atomic_failure_order(");
+            gen_expr(order);
+            genf(")");
+        }
+        genf(")");
+    } else if (sym->name == str_intern("atomic_fence")) {
+        genf("atomic_thread_fence((memory_order)(");
+        gen_expr(expr->call.args[0]);
+        genf("))");
+    } else if (sym->name == str_intern("vload")) {
+        Type *result_type = get_resolved_type(expr);
+        genf("(*(const %s_u *)(", cdecl_name(result_type));
+        gen_expr(expr->call.args[0]);
+        genf("))");
+    } else if (sym->name == str_intern("vstore")) {
+        Type *value_type = unqualify_type(get_resolved_type(expr->call.args[1]));
+        genf("(void)(*(%s_u *)(", cdecl_name(value_type));
+        gen_expr(expr->call.args[0]);
+        genf(") = (");
+        gen_expr(expr->call.args[1]);
+        genf("))");
+    } else if (sym->name == str_intern("vshuffle")) {
+        genf("__builtin_shufflevector(");
+        for (int i = 0; i < expr->call.num_args; i++) {
+            if (i != 0) {
+                genf(", ");
+            }
+            gen_expr(expr->call.args[i]);
+        }
+        genf(")");
+    } else if (sym->name == str_intern("vconvert")) {
+        genf("__builtin_convertvector((");
+        gen_expr(expr->call.args[0]);
+        genf("), %s)", cdecl_name(get_resolved_type(expr)));
     } else {
         fatal_error(expr->pos, "Call to unimplemented intrinsic %s", sym->name);
     }
@@ -668,8 +774,10 @@ void gen_expr(Expr *expr) {
         if (is_intrinsic(sym)) {
             gen_intrinsic(sym, expr);
         } else {
-            if (sym && sym->kind == SYM_TYPE) {
-                genf("(%s)", get_gen_name(sym));
+            bool is_conv = sym && sym->kind == SYM_TYPE;
+            if (is_conv) {
+                // Parenthesized so that postfix operators apply to the converted value.
+                genf("((%s)", get_gen_name(sym));
             } else {
                 gen_expr(expr->call.expr);
             }
@@ -680,7 +788,7 @@ void gen_expr(Expr *expr) {
                 }
                 gen_expr(expr->call.args[i]);
             }
-            genf(")");
+            genf(is_conv ? "))" : ")");
         }
         break;
     }
@@ -704,10 +812,17 @@ void gen_expr(Expr *expr) {
         if (sym) {
             genf("(%s)", get_gen_name(sym));
         } else {
-            gen_expr(expr->field.expr);
             Type *type = unqualify_type(get_resolved_type(expr->field.expr));
             const char *name = expr->field.name;
-            genf("%s%s", type->kind == TYPE_PTR ? "->" : ".", name);
+            Type *vector_type = type->kind == TYPE_PTR ? unqualify_type(type->base) : type;
+            if (is_vector_type(vector_type)) {
+                genf("%s", type->kind == TYPE_PTR ? "(*" : "");
+                gen_expr(expr->field.expr);
+                genf("%s[%d]", type->kind == TYPE_PTR ? ")" : "", vector_field_index(name));
+            } else {
+                gen_expr(expr->field.expr);
+                genf("%s%s", type->kind == TYPE_PTR ? "->" : ".", name);
+            }
         }
         break;
     }
@@ -1386,6 +1501,14 @@ void gen_typeinfo(Type *type) {
             genf(", .count = %d},", type->num_elems);
         }
         break;
+    case TYPE_VECTOR:
+        gen_typeinfo_header("TYPE_VECTOR", type);
+        genf(", .name = ");
+        gen_str(vector_type_name(type), false);
+        genf(", .base = ");
+        gen_typeid(type->base);
+        genf(", .count = %d},", type->num_elems);
+        break;
     case TYPE_STRUCT:
     case TYPE_UNION:
         gen_typeinfo_header(type->kind == TYPE_STRUCT ? "TYPE_STRUCT" : "TYPE_UNION", type);
@@ -1451,6 +1574,12 @@ void gen_preamble(void) {
     }
 }
 
+void gen_intrinsic_instances(void) {
+    if (gen_instances_buf) {
+        genlnf("%s", gen_instances_buf);
+    }
+}
+
 void gen_postamble(void) {
     if (gen_postamble_buf) {
         genlnf("%s", gen_postamble_buf);
@@ -1466,7 +1595,15 @@ void gen_all(void) {
     genln();
     gen_sorted_decls();
     gen_typeinfos();
+    // Intrinsic instances are collected while generating definitions but must precede them.
+    char *decls_buf = gen_buf;
+    gen_buf = NULL;
+    gen_pos = (SrcPos){0};
     gen_defs();
+    char *defs_buf = gen_buf;
+    gen_buf = decls_buf;
+    gen_intrinsic_instances();
+    genf("%s", defs_buf ? defs_buf : "");
     gen_foreign_sources();
     genln();
     gen_postamble();
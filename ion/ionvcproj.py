@@ -6,6 +6,9 @@ import uuid
 import string
 import glob
 
+# std's atomics lower to C11 <stdatomic.h>, which MSVC only provides under /std:c11 /experimental:c11atomics.
+# That needs Visual Studio 2022 17.5 or later (the v143 toolset).
+
 template = r"""<?xml version="1.0" encoding="utf-8"?>
 <Project DefaultTargets="Build" ToolsVersion="4.0" xmlns="http://schemas.microsoft.com/developer/msbuild/2003">
   <ItemGroup Label="ProjectConfigurations">
@@ -39,6 +42,7 @@ template = r"""<?xml version="1.0" encoding="utf-8"?>
     <PlatformToolset Condition="'$$(VisualStudioVersion)' == '12.0' Or '$$(PlatformToolsetVersion)' == '120' Or '$$(MSBuildToolsVersion)' == '12.0'">v120_xp</PlatformToolset>
     <PlatformToolset Condition="'$$(VisualStudioVersion)' == '14.0' Or '$$(PlatformToolsetVersion)' == '140' Or '$$(MSBuildToolsVersion)' == '14.0'">v140</PlatformToolset>
     <PlatformToolset Condition="'$$(VisualStudioVersion)' == '15.0' Or '$$(PlatformToolsetVersion)' == '141' Or '$$(MSBuildToolsVersion)' == '15.0'">v141</PlatformToolset>
+    <PlatformToolset Condition="'$$(VisualStudioVersion)' == '17.0' Or '$$(PlatformToolsetVersion)' == '143' Or '$$(MSBuildToolsVersion)' == '17.0'">v143</PlatformToolset>
     <UseOfMfc>false</UseOfMfc>
     <CharacterSet>MultiByte</CharacterSet>
     <WholeProgramOptimization Condition="'$$(Configuration)'=='Release'">true</WholeProgramOptimization>
@@ -70,6 +74,7 @@ template = r"""<?xml version="1.0" encoding="utf-8"?>
       <PreprocessorDefinitions Condition="'$$(Configuration)'=='Debug'">_DEBUG;%(PreprocessorDefinitions)</PreprocessorDefinitions>
       <PreprocessorDefinitions Condition="'$$(Configuration)'=='Release'">NDEBUG;%(PreprocessorDefinitions)</PreprocessorDefinitions>
       <PreprocessorDefinitions Condition="'$$(Platform)'=='x64'">WIN64;_WIN64;%(PreprocessorDefinitions)</PreprocessorDefinitions>
+      <AdditionalOptions>/std:c11 /experimental:c11atomics %(AdditionalOptions)</AdditionalOptions>
     </ClCompile>
     <ClCompile Condition="'$$(Configuration)'=='Debug'">
       <Optimization>Disabled</Optimization>
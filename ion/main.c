@@ -21,5 +21,8 @@ bool flag_nolinesync;
 #include "test.c"
 
 int main(int argc, const char **argv) {
+#if defined(ION_TEST)
+    common_test();
+#endif
     return ion_main(argc, argv);
 }
@@ -296,6 +296,9 @@ void put_type_name(char **buf, Type *type) {
             put_type_name(buf, type->base);
             buf_printf(*buf, "[%zu]", type->num_elems);
             break;
+        case TYPE_VECTOR:
+            buf_printf(*buf, "%s", vector_type_name(type));
+            break;
         case TYPE_FUNC:
             buf_printf(*buf, "func(");
             for (size_t i = 0; i < type->func.num_params; i++) {
@@ -485,6 +488,8 @@ bool is_castable(Operand *operand, Type *dest) {
         return is_ptr_like_type(dest);
     } else if (is_ptr_like_type(dest) && is_ptr_like_type(src)) {
         return true;
+    } else if (is_vector_type(dest) && is_vector_type(src)) {
+        return type_sizeof(dest) == type_sizeof(src);
     } else {
         return false;
     }
@@ -762,6 +767,9 @@ Type *resolve_typespec_strict(Typespec *typespec, bool with_const) {
         resolve_sym(sym);
         set_resolved_sym(typespec, sym);
         result = sym->type;
+        if (is_vector_type(result) && !get_reachable(result)) {
+            set_reachable(result);
+        }
         break;
     }
     case TYPESPEC_CONST:
@@ -1134,7 +1142,7 @@ void resolve_stmt_assign(Stmt *stmt) {
                 set_pointer_promo_type(left_expr, type_ptr(qualify_type(type_char, left.type->base)));
             }
             result = operand_rvalue(left.type);
-        } else if (is_arithmetic_type(left.type) && is_arithmetic_type(right.type)) {
+        } else if ((is_arithmetic_type(left.type) && is_arithmetic_type(right.type)) || is_vector_type(unqualify_type(left.type))) {
             result = resolve_expr_binary_op(binary_op, assign_op_name, stmt->pos, left, right, left_expr, right_expr);
         } else {
             fatal_error(stmt->pos, "Invalid operand types for %s", assign_op_name);
@@ -1464,6 +1472,17 @@ Operand resolve_expr_field(Expr *expr) {
         type = unqualify_type(operand.type);
         complete_type(type);
     }
+    if (is_vector_type(type)) {
+        int index = vector_field_index(expr->field.name);
+        if (index < 0 || index >= type->num_elems) {
+            fatal_error(expr->pos, "No lane named '%s' in %s", expr->field.name, get_type_name(type));
+        }
+        Operand lane_operand = operand.is_lvalue ? operand_lvalue(type->base) : operand_rvalue(type->base);
+        if (was_const_type) {
+            lane_operand.type = type_const(lane_operand.type);
+        }
+        return lane_operand;
+    }
     if (!is_aggregate_type(type)) {
         fatal_error(expr->pos, "Can only access fields on aggregates or pointers to aggregates");
         return operand_null;
@@ -1682,11 +1701,17 @@ Operand resolve_expr_unary(Expr *expr) {
         return operand_lvalue(type->base);
     case TOKEN_ADD:
     case TOKEN_SUB:
+        if (is_vector_type(type)) {
+            return operand_rvalue(type);
+        }
         if (!is_arithmetic_type(type)) {
             fatal_error(expr->pos, "Can only use unary %s with arithmetic types", token_kind_name(expr->unary.op));
         }
         return resolve_unary_op(expr->unary.op, operand);
     case TOKEN_NEG:
+        if (is_vector_type(type) && is_integer_type(type->base)) {
+            return operand_rvalue(type);
+        }
         if (!is_integer_type(type)) {
             fatal_error(expr->pos, "Can only use ~ with integer types");
         }
@@ -1735,7 +1760,68 @@ bool compatible_pointer_arith(Type *left, Type *right, Expr *left_expr, Expr *ri
     return false;
 }
 
+bool is_comparison_op(TokenKind op) {
+    return TOKEN_FIRST_CMP <= op && op <= TOKEN_LAST_CMP;
+}
+
+// Vector operations are element-wise. A scalar operand is broadcast to every lane, so it is converted to the element
+// type here rather than promoted. Comparisons produce a mask vector with a signed lane of the same width which is
+// all ones where the comparison holds.
+Operand resolve_expr_binary_vector_op(TokenKind op, const char *op_name, SrcPos pos, Operand left, Operand right, Expr *left_expr, Expr *right_expr) {
+    Type *left_type = unqualify_type(left.type);
+    Type *right_type = unqualify_type(right.type);
+    Type *type = is_vector_type(left_type) ? left_type : right_type;
+    if (!is_vector_type(left_type)) {
+        if (!is_arithmetic_type(left_type)) {
+            fatal_error(pos, "Left operand of %s must have arithmetic or %s type", op_name, get_type_name(type));
+        }
+        set_type_conv(left_expr, type->base);
+    } else if (!is_vector_type(right_type)) {
+        if (!is_arithmetic_type(right_type)) {
+            fatal_error(pos, "Right operand of %s must have arithmetic or %s type", op_name, get_type_name(type));
+        }
+        set_type_conv(right_expr, type->base);
+    } else if (left_type != right_type) {
+        fatal_error(pos, "Operands of %s must have the same vector type, got %s and %s", op_name, get_type_name(left_type), get_type_name(right_type));
+    }
+    switch (op) {
+    case TOKEN_ADD:
+    case TOKEN_SUB:
+    case TOKEN_MUL:
+    case TOKEN_DIV:
+        return operand_rvalue(type);
+    case TOKEN_MOD:
+    case TOKEN_AND:
+    case TOKEN_OR:
+    case TOKEN_XOR:
+    case TOKEN_LSHIFT:
+    case TOKEN_RSHIFT:
+        if (!is_integer_type(type->base)) {
+            fatal_error(pos, "Operands of %s must have integer element type", op_name);
+        }
+        return operand_rvalue(type);
+    case TOKEN_EQ:
+    case TOKEN_NOTEQ:
+    case TOKEN_LT:
+    case TOKEN_LTEQ:
+    case TOKEN_GT:
+    case TOKEN_GTEQ: {
+        Type *mask = type_vector_mask(type);
+        if (!get_reachable(mask)) {
+            set_reachable(mask);
+        }
+        return operand_rvalue(mask);
+    }
+    default:
+        fatal_error(pos, "Operands of %s cannot have vector type", op_name);
+        return operand_null;
+    }
+}
+
 Operand resolve_expr_binary_op(TokenKind op, const char *op_name, SrcPos pos, Operand left, Operand right, Expr *left_expr, Expr *right_expr) {
+    if (is_vector_type(unqualify_type(left.type)) || is_vector_type(unqualify_type(right.type))) {
+        return resolve_expr_binary_vector_op(op, op_name, pos, left, right, left_expr, right_expr);
+    }
     switch (op) {
     case TOKEN_MUL:
     case TOKEN_DIV:
@@ -1912,7 +1998,12 @@ Operand resolve_expr_binary(Expr *expr) {
     Operand right = resolve_expr_rvalue(expr->binary.right);
     TokenKind op = expr->binary.op;
     const char *op_name = token_kind_name(op);
-    return resolve_expr_binary_op(op, op_name, expr->pos, left, right, expr->binary.left, expr->binary.right);
+    Operand result = resolve_expr_binary_op(op, op_name, expr->pos, left, right, expr->binary.left, expr->binary.right);
+    if (is_vector_type(result.type) && is_comparison_op(op)) {
+        // C compilers pick their own lane type for comparison results, e.g. long rather than long long.
+        set_type_conv(expr, result.type);
+    }
+    return result;
 }
 
 Operand resolve_expr_compound(Expr *expr, Type *expected_type) {
@@ -1981,6 +2072,19 @@ Operand resolve_expr_compound(Expr *expr, Type *expected_type) {
         if (type->incomplete_elems) {
             type = type_array(type->base, max_index + 1, false);
         }
+    } else if (type->kind == TYPE_VECTOR) {
+        if (expr->compound.num_fields > type->num_elems) {
+            fatal_error(expr->pos, "Too many lanes in compound literal for %s", get_type_name(type));
+        }
+        for (size_t i = 0; i < expr->compound.num_fields; i++) {
+            CompoundField field = expr->compound.fields[i];
+            if (field.kind != FIELD_DEFAULT) {
+                fatal_error(field.pos, "Vector compound literals can only have positional initializers");
+            }
+            if (!resolve_typed_init(field.pos, type->base, field.init)) {
+                fatal_error(field.pos, "Invalid type in compound literal initializer for vector type. Expected %s", get_type_name(type->base));
+            }
+        }
     } else {
         if (type == type_void) {
             fatal_error(expr->pos, "Anonymous compound literal in context expecting void type");
@@ -2282,6 +2386,110 @@ Operand resolve_expr_call_intrinsic(Operand func, Expr *expr, Type *expected_typ
             fatal_error(expr->pos, "anew base type cannot be incomplete or have size 0");
         }
         return operand_rvalue(type_ptr(expected_type->base));
+    } else if (sym->name == str_intern("atomic_load") || sym->name == str_intern("atomic_store") ||
+        sym->name == str_intern("atomic_exchange") || sym->name == str_intern("atomic_cas") || sym->name == str_intern("atomic_add")) {
+        Operand ptr = resolve_expr_rvalue(expr->call.args[0]);
+        if (!is_ptr_type(ptr.type)) {
+            fatal_error(expr->call.args[0]->pos, "Argument 1 of %s must have pointer type", sym->name);
+        }
+        if (is_const_type(ptr.type->base) && sym->name != str_intern("atomic_load")) {
+            fatal_error(expr->call.args[0]->pos, "Argument 1 of %s must not point to const", sym->name);
+        }
+        Type *base_type = unqualify_type(ptr.type->base);
+        if (sym->name == str_intern("atomic_add")) {
+            if (!is_integer_type(base_type) || base_type == type_bool) {
+                fatal_error(expr->call.args[0]->pos, "Argument 1 of %s must point to an integer", sym->name);
+            }
+        } else if (!is_integer_type(base_type) && !is_ptr_like_type(base_type)) {
+            fatal_error(expr->call.args[0]->pos, "Argument 1 of %s must point to an integer or pointer", sym->name);
+        }
+        size_t i = 1;
+        if (sym->name == str_intern("atomic_cas")) {
+            Operand expected = resolve_expr_rvalue(expr->call.args[i]);
+            if (!is_ptr_type(expected.type) || expected.type->base != base_type) {
+                fatal_error(expr->call.args[i]->pos, "Argument 2 of %s must have the same type as argument 1", sym->name);
+            }
+            i++;
+        }
+        if (sym->name != str_intern("atomic_load")) {
+            Operand value = resolve_expected_expr_rvalue(expr->call.args[i], base_type);
+            if (!convert_operand(&value, base_type)) {
+                fatal_error(expr->call.args[i]->pos, "Argument %zu of %s not convertible to argument 1's base type", i + 1, sym->name);
+            }
+            i++;
+        }
+        Type *order_type = func.type->func.params[i];
+        Operand order = resolve_expected_expr_rvalue(expr->call.args[i], order_type);
+        if (!convert_operand(&order, order_type)) {
+            fatal_error(expr->call.args[i]->pos, "Argument %zu of %s must be a memory order", i + 1, sym->name);
+        }
+        if (sym->name == str_intern("atomic_store")) {
+            return operand_rvalue(type_void);
+        } else if (sym->name == str_intern("atomic_cas")) {
+            return operand_rvalue(type_bool);
+        } else {
+            return operand_rvalue(base_type);
+        }
+    } else if (sym->name == str_intern("vload")) {
+        Operand src = resolve_expr_rvalue(expr->call.args[0]);
+        if (!convert_operand(&src, func.type->func.params[0])) {
+            fatal_error(expr->call.args[0]->pos, "Argument 1 of %s must have pointer type", sym->name);
+        }
+        Type *type = expected_type ? unqualify_type(expected_type) : NULL;
+        if (!is_vector_type(type)) {
+            fatal_error(expr->pos, "%s can only be used when its inferred type is a vector type", sym->name);
+        }
+        return operand_rvalue(type);
+    } else if (sym->name == str_intern("vstore")) {
+        Operand dest = resolve_expr_rvalue(expr->call.args[0]);
+        if (!convert_operand(&dest, func.type->func.params[0])) {
+            fatal_error(expr->call.args[0]->pos, "Argument 1 of %s must have non-const pointer type", sym->name);
+        }
+        Operand value = resolve_expr_rvalue(expr->call.args[1]);
+        if (!is_vector_type(unqualify_type(value.type))) {
+            fatal_error(expr->call.args[1]->pos, "Argument 2 of %s must have vector type", sym->name);
+        }
+        return operand_rvalue(type_void);
+    } else if (sym->name == str_intern("vshuffle")) {
+        Operand left = resolve_expr_rvalue(expr->call.args[0]);
+        Operand right = resolve_expr_rvalue(expr->call.args[1]);
+        Type *type = unqualify_type(left.type);
+        if (!is_vector_type(type) || unqualify_type(right.type) != type) {
+            fatal_error(expr->pos, "Arguments 1 and 2 of %s must have the same vector type", sym->name);
+        }
+        size_t num_indices = expr->call.num_args - 2;
+        for (size_t i = 2; i < expr->call.num_args; i++) {
+            Operand index = resolve_const_expr(expr->call.args[i]);
+            if (!is_integer_type(index.type)) {
+                fatal_error(expr->call.args[i]->pos, "Lane index of %s must be an integer constant", sym->name);
+            }
+            cast_operand(&index, type_llong);
+            if (!(0 <= index.val.ll && index.val.ll < 2 * (long long)type->num_elems)) {
+                fatal_error(expr->call.args[i]->pos, "Lane index of %s out of range", sym->name);
+            }
+        }
+        if (!is_valid_vector(type->base, num_indices)) {
+            fatal_error(expr->pos, "No vector type with %zu lanes of %s", num_indices, get_type_name(type->base));
+        }
+        Type *result_type = type_vector(type->base, num_indices);
+        if (!get_reachable(result_type)) {
+            set_reachable(result_type);
+        }
+        return operand_rvalue(result_type);
+    } else if (sym->name == str_intern("vconvert")) {
+        Operand operand = resolve_expr_rvalue(expr->call.args[0]);
+        Type *src_type = unqualify_type(operand.type);
+        Type *type = expected_type ? unqualify_type(expected_type) : NULL;
+        if (!is_vector_type(src_type)) {
+            fatal_error(expr->call.args[0]->pos, "Argument 1 of %s must have vector type", sym->name);
+        }
+        if (!is_vector_type(type)) {
+            fatal_error(expr->pos, "%s can only be used when its inferred type is a vector type", sym->name);
+        }
+        if (type->num_elems != src_type->num_elems) {
+            fatal_error(expr->pos, "%s from %s to %s changes the number of lanes", sym->name, get_type_name(src_type), get_type_name(type));
+        }
+        return operand_rvalue(type);
     } else {
         return resolve_expr_call_default(func, expr);
     }
@@ -2299,6 +2507,9 @@ Operand resolve_expr_call(Expr *expr, Type *expected_type) {
             if (!cast_operand(&operand, sym->type)) {
                 fatal_error(expr->pos, "Invalid type cast from %s to %s", get_type_name(operand.type), get_type_name(sym->type));
             }
+            if (is_vector_type(sym->type) && !get_reachable(sym->type)) {
+                set_reachable(sym->type);
+            }
             set_resolved_sym(expr->call.expr, sym);
             return operand;
         }
@@ -2374,6 +2585,17 @@ Operand resolve_expr_index(Expr *expr) {
         operand.type = operand.type->aggregate.fields[i].type;
         return operand;
     }
+    Type *vector_type = unqualify_type(operand.type);
+    if (is_vector_type(vector_type)) {
+        if (index.is_const) {
+            convert_operand(&index, type_llong);
+            if (!(0 <= index.val.ll && index.val.ll < (long long)vector_type->num_elems)) {
+                fatal_error(expr->pos, "Vector lane index out of range");
+            }
+        }
+        Type *lane_type = is_const_type(operand.type) ? type_const(vector_type->base) : vector_type->base;
+        return operand.is_lvalue ? operand_lvalue(lane_type) : operand_rvalue(lane_type);
+    }
     operand = operand_decay(operand);
     if (!is_ptr_type(operand.type)) {
         fatal_error(expr->pos, "Can only index aggregates, arrays and pointers");
@@ -2762,6 +2984,16 @@ void init_builtin_syms() {
     sym_global_type("ullong", type_ullong);
     sym_global_type("float", type_float);
     sym_global_type("double", type_double);
+    Type *elem_types[] = {type_schar, type_uchar, type_short, type_ushort, type_int, type_uint, type_llong, type_ullong, type_float, type_double};
+    for (size_t i = 0; i < sizeof(elem_types)/sizeof(*elem_types); i++) {
+        for (size_t num_elems = 2; num_elems * type_sizeof(elem_types[i]) <= MAX_VECTOR_SIZE; num_elems *= 2) {
+            if (is_valid_vector(elem_types[i], num_elems)) {
+                Type *type = type_vector(elem_types[i], num_elems);
+                Sym *sym = sym_global_type(vector_type_name(type), type);
+                sym->external_name = strf("vector%d", type->typeid);
+            }
+        }
+    }
 }
 
 void postinit_builtin(void) {
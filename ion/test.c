@@ -15,6 +15,7 @@ void intern_test(void) {
 void common_test(void) {
     buf_test();
     intern_test();
+    hash_test();
     map_test();
 
     char *str1 = strf("%d %d", 1, 2);
@@ -20,6 +20,7 @@ typedef enum TypeKind {
     TYPE_DOUBLE,
     TYPE_PTR,
     TYPE_FUNC,
+    TYPE_VECTOR,
     TYPE_ARRAY,
     TYPE_STRUCT,
     TYPE_UNION,
@@ -141,6 +142,10 @@ bool is_const_type(Type *type) {
     return type && type->kind == TYPE_CONST;
 }
 
+bool is_vector_type(Type *type) {
+    return type && type->kind == TYPE_VECTOR;
+}
+
 bool is_array_type(Type *type) {
     return type && type->kind == TYPE_ARRAY;
 }
@@ -350,6 +355,88 @@ Type *type_array(Type *base, size_t num_elems, bool incomplete_elems) {
     return type;
 }
 
+// Vectors lower to GCC/Clang vector extensions, which align them to their full size. The element types are the
+// fixed-width ones so that each vector has exactly one name.
+const char *vector_elem_names[NUM_TYPE_KINDS] = {
+    [TYPE_SCHAR] = "int8",
+    [TYPE_UCHAR] = "uint8",
+    [TYPE_SHORT] = "int16",
+    [TYPE_USHORT] = "uint16",
+    [TYPE_INT] = "int32",
+    [TYPE_UINT] = "uint32",
+    [TYPE_LLONG] = "int64",
+    [TYPE_ULLONG] = "uint64",
+    [TYPE_FLOAT] = "float",
+    [TYPE_DOUBLE] = "double",
+};
+
+#define MIN_VECTOR_SIZE 8
+#define MAX_VECTOR_SIZE 64
+
+bool is_vector_elem_type(Type *type) {
+    return vector_elem_names[type->kind] != NULL;
+}
+
+Map cached_vector_types;
+Type **vector_types;
+
+Type *type_vector(Type *base, size_t num_elems) {
+    assert(is_vector_elem_type(base) && IS_POW2(num_elems));
+    uint64_t hash = hash_mix(hash_ptr(base), hash_uint64(num_elems));
+    uint64_t key = hash ? hash : 1;
+    CachedArrayType *cached = map_get_from_uint64(&cached_vector_types, key);
+    for (CachedArrayType *it = cached; it; it = it->next) {
+        if (it->type->base == base && it->type->num_elems == num_elems) {
+            return it->type;
+        }
+    }
+    Type *type = type_alloc(TYPE_VECTOR);
+    type->size = num_elems * type_sizeof(base);
+    type->align = type->size;
+    type->base = base;
+    type->num_elems = num_elems;
+    CachedArrayType *new_cached = xmalloc(sizeof(CachedArrayType));
+    new_cached->type = type;
+    new_cached->next = cached;
+    map_put_from_uint64(&cached_vector_types, key, new_cached);
+    buf_push(vector_types, type);
+    return type;
+}
+
+bool is_valid_vector(Type *base, size_t num_elems) {
+    size_t size = num_elems * type_sizeof(base);
+    return is_vector_elem_type(base) && num_elems >= 2 && IS_POW2(num_elems) && MIN_VECTOR_SIZE <= size && size <= MAX_VECTOR_SIZE;
+}
+
+// float4 and double2 for floating elements, int32x4 and uint8x16 for integer ones.
+const char *vector_type_name(Type *type) {
+    const char *elem = vector_elem_names[type->base->kind];
+    return strf(is_floating_type(type->base) ? "%s%zu" : "%sx%zu", elem, type->num_elems);
+}
+
+// The result of comparing two vectors: a signed lane per element, all ones where the comparison holds.
+Type *type_vector_mask(Type *type) {
+    Type *masks[] = {[1] = type_schar, [2] = type_short, [4] = type_int, [8] = type_llong};
+    return type_vector(masks[type_sizeof(type->base)], type->num_elems);
+}
+
+// Swizzle-style names for the first four lanes.
+int vector_field_index(const char *name) {
+    if (name[0] && !name[1]) {
+        switch (name[0]) {
+        case 'x':
+            return 0;
+        case 'y':
+            return 1;
+        case 'z':
+            return 2;
+        case 'w':
+            return 3;
+        }
+    }
+    return -1;
+}
+
 typedef struct TypeLink {
     Type *type;
     struct TypeLink *next;